@@ -0,0 +1,235 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/examples/cc/CMakeLists.txt"
+  "/root/repo/src/cc/chunk/CMakeLists.txt"
+  "/root/repo/src/cc/common/CMakeLists.txt"
+  "/root/repo/src/cc/devtools/CMakeLists.txt"
+  "/root/repo/src/cc/emulator/CMakeLists.txt"
+  "/root/repo/src/cc/kfsio/CMakeLists.txt"
+  "/root/repo/src/cc/libclient/CMakeLists.txt"
+  "/root/repo/src/cc/meta/CMakeLists.txt"
+  "/root/repo/src/cc/qcdio/CMakeLists.txt"
+  "/root/repo/src/cc/qcrs/CMakeLists.txt"
+  "/root/repo/src/cc/tests/CMakeLists.txt"
+  "/root/repo/src/cc/tools/CMakeLists.txt"
+  "/root/repo/src/test-scripts/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/BoostDetectToolset-1.74.0.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/boost_regex-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/boost_regex-config.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/libboost_regex-variant-shared.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_regex-1.74.0/libboost_regex-variant-static.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindJavaCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePushCheckState.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindJNI.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/common/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/meta/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/chunk/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/libclient/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/kfsio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/devtools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/emulator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/test-scripts/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/qcdio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cc/qcrs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/cc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/cc/common/CMakeFiles/version.dir/DependInfo.cmake"
+  "src/cc/common/CMakeFiles/kfsCommon-shared.dir/DependInfo.cmake"
+  "src/cc/common/CMakeFiles/kfsCommon.dir/DependInfo.cmake"
+  "src/cc/meta/CMakeFiles/kfsMeta.dir/DependInfo.cmake"
+  "src/cc/meta/CMakeFiles/kfsMeta-shared.dir/DependInfo.cmake"
+  "src/cc/meta/CMakeFiles/metaserver.dir/DependInfo.cmake"
+  "src/cc/meta/CMakeFiles/logcompactor.dir/DependInfo.cmake"
+  "src/cc/meta/CMakeFiles/filelister.dir/DependInfo.cmake"
+  "src/cc/meta/CMakeFiles/qfsfsck.dir/DependInfo.cmake"
+  "src/cc/meta/CMakeFiles/checkpointbench.dir/DependInfo.cmake"
+  "src/cc/meta/CMakeFiles/kfstreebench.dir/DependInfo.cmake"
+  "src/cc/chunk/CMakeFiles/chunkserver.dir/DependInfo.cmake"
+  "src/cc/chunk/CMakeFiles/chunkscrubber.dir/DependInfo.cmake"
+  "src/cc/libclient/CMakeFiles/kfsClient.dir/DependInfo.cmake"
+  "src/cc/libclient/CMakeFiles/kfsClient-shared.dir/DependInfo.cmake"
+  "src/cc/kfsio/CMakeFiles/kfsIO.dir/DependInfo.cmake"
+  "src/cc/kfsio/CMakeFiles/kfsIO-shared.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/tools.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/tools-shared.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/cptoqfs.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/cpfromqfs.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/qfsshell.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/qfstoggleworm.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/qfsput.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/qfsstats.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/qfsfileenum.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/qfsdataverify.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/qfshibernate.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/qfscat.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/qfsping.dir/DependInfo.cmake"
+  "src/cc/tools/CMakeFiles/qfstool.dir/DependInfo.cmake"
+  "src/cc/devtools/CMakeFiles/checksum.dir/DependInfo.cmake"
+  "src/cc/devtools/CMakeFiles/dirtree_creator.dir/DependInfo.cmake"
+  "src/cc/devtools/CMakeFiles/iobuffer.dir/DependInfo.cmake"
+  "src/cc/devtools/CMakeFiles/logger.dir/DependInfo.cmake"
+  "src/cc/devtools/CMakeFiles/rand-sfmt.dir/DependInfo.cmake"
+  "src/cc/devtools/CMakeFiles/requestparser.dir/DependInfo.cmake"
+  "src/cc/devtools/CMakeFiles/sortedhash.dir/DependInfo.cmake"
+  "src/cc/devtools/CMakeFiles/stlset.dir/DependInfo.cmake"
+  "src/cc/tests/CMakeFiles/dirfile_test.dir/DependInfo.cmake"
+  "src/cc/tests/CMakeFiles/dirscan_test.dir/DependInfo.cmake"
+  "src/cc/tests/CMakeFiles/reader_perftest.dir/DependInfo.cmake"
+  "src/cc/tests/CMakeFiles/reader_test.dir/DependInfo.cmake"
+  "src/cc/tests/CMakeFiles/readwrite_test.dir/DependInfo.cmake"
+  "src/cc/tests/CMakeFiles/recordappend_test.dir/DependInfo.cmake"
+  "src/cc/tests/CMakeFiles/seekwrite_test.dir/DependInfo.cmake"
+  "src/cc/tests/CMakeFiles/truncate_test.dir/DependInfo.cmake"
+  "src/cc/tests/CMakeFiles/writer_perftest.dir/DependInfo.cmake"
+  "src/cc/tests/CMakeFiles/writer_test.dir/DependInfo.cmake"
+  "src/cc/emulator/CMakeFiles/kfsEmulator.dir/DependInfo.cmake"
+  "src/cc/emulator/CMakeFiles/kfsEmulator-shared.dir/DependInfo.cmake"
+  "src/cc/emulator/CMakeFiles/rebalanceplanner.dir/DependInfo.cmake"
+  "src/cc/emulator/CMakeFiles/rebalanceexecutor.dir/DependInfo.cmake"
+  "src/cc/emulator/CMakeFiles/replicachecker.dir/DependInfo.cmake"
+  "src/cc/qcdio/CMakeFiles/qcdio.dir/DependInfo.cmake"
+  "src/cc/qcdio/CMakeFiles/qcdio-shared.dir/DependInfo.cmake"
+  "src/cc/qcrs/CMakeFiles/kfsrs.dir/DependInfo.cmake"
+  "src/cc/qcrs/CMakeFiles/kfsrs-shared.dir/DependInfo.cmake"
+  "src/cc/qcrs/CMakeFiles/rstest.dir/DependInfo.cmake"
+  "src/cc/qcrs/CMakeFiles/rsmktable.dir/DependInfo.cmake"
+  "examples/cc/CMakeFiles/qfssample.dir/DependInfo.cmake"
+  )
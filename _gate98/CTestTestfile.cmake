@@ -0,0 +1,19 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_gate98
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("src/cc/common")
+subdirs("src/cc/meta")
+subdirs("src/cc/chunk")
+subdirs("src/cc/libclient")
+subdirs("src/cc/kfsio")
+subdirs("src/cc/tools")
+subdirs("src/cc/devtools")
+subdirs("src/cc/tests")
+subdirs("src/cc/emulator")
+subdirs("src/test-scripts")
+subdirs("src/cc/qcdio")
+subdirs("src/cc/qcrs")
+subdirs("examples/cc")
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/examples/cc/qfssample_main.cc" "examples/cc/CMakeFiles/qfssample.dir/qfssample_main.o" "gcc" "examples/cc/CMakeFiles/qfssample.dir/qfssample_main.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate98/src/cc/libclient/CMakeFiles/kfsClient.dir/DependInfo.cmake"
+  "/root/repo/_gate98/src/cc/qcdio/CMakeFiles/qcdio.dir/DependInfo.cmake"
+  "/root/repo/_gate98/src/cc/kfsio/CMakeFiles/kfsIO.dir/DependInfo.cmake"
+  "/root/repo/_gate98/src/cc/common/CMakeFiles/kfsCommon.dir/DependInfo.cmake"
+  "/root/repo/_gate98/src/cc/qcrs/CMakeFiles/kfsrs.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
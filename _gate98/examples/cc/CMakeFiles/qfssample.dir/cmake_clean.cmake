@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/qfssample.dir/qfssample_main.o"
+  "CMakeFiles/qfssample.dir/qfssample_main.o.d"
+  "qfssample"
+  "qfssample.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/qfssample.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()